@@ -8,9 +8,19 @@ pause()
     read junk
 }
 
+compare()
+{
+    if diff -u test-ad-correct.vcf $1; then
+	printf "No differences found, test passed.\n"
+    else
+	printf "Differences found, test failed.\n"
+    fi
+}
+
 cd ..
 ./cave-man-install.sh
 cd Test
+# Uncompressed VCF: header copied via mmap
 ../ad2vcf test.vcf 10 < test.sam
 
 cat << EOM
@@ -20,11 +30,19 @@ Comparing your results to the reference...
 ======================================================================
 
 EOM
-if diff -u test-ad-correct.vcf test-ad.vcf; then
-    printf "No differences found, test passed.\n"
-else
-    printf "Differences found, test failed.\n"
-fi
+compare test-ad.vcf
+
+# Piped SAM and compressed VCF: header copied via stdio
+cat test.sam | ../ad2vcf test.vcf 10
+printf "\n=== Piped SAM input\n"
+compare test-ad.vcf
+
+gzip -c test.vcf > test-gz.vcf.gz
+../ad2vcf test-gz.vcf.gz 10 < test.sam
+gzip -dc test-gz-ad.vcf.gz > test-gz-ad.vcf
+printf "\n=== Compressed VCF input\n"
+compare test-gz-ad.vcf
+rm -f test-gz.vcf.gz test-gz-ad.vcf.gz test-gz-ad.vcf
 mv test-ad.vcf test-ad-last.vcf
 
 cat << EOM
@@ -2,6 +2,9 @@
 int main(int argc, const char *argv[]);
 void usage(const char *argv[]);
 int ad2vcf(const char *argv[], FILE *sam_stream);
+int mmap_file_open(mmap_file_t *mf, int fd);
+void mmap_file_close(mmap_file_t *mf);
+size_t vcf_header_len(const char *data, size_t data_len);
 int skip_upstream_alignments(bl_vcf_t *vcf_call, FILE *sam_stream, bl_sam_buff_t *sam_buff, FILE *vcf_out_stream, vcf_stats_t *vcf_stats);
 int allelic_depth(bl_vcf_t *vcf_call, FILE *sam_stream, bl_sam_buff_t *sam_buff, FILE *vcf_out_stream, vcf_stats_t *vcf_stats);
 void vcf_stats_update_allele_count(vcf_stats_t *vcf_stats, bl_vcf_t *vcf_call, bl_sam_t *sam_alignment);
@@ -22,6 +22,10 @@
 #include <ctype.h>
 #include <errno.h>
 #include <sys/param.h>          // MIN()
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>           // mmap(), madvise()
+#include <unistd.h>
 
 #include <xtend/file.h>         // xt_fopen()
 #include <xtend/string.h>       // Linux strlcpy()
@@ -74,12 +78,16 @@ int     ad2vcf(const char *argv[], FILE *sam_stream)
 		    *vcf_out_stream,
 		    *vcf_meta_stream;
     bl_vcf_t        vcf_call;   // Use bl_vcf_init() function to initizalize
-    bool            more_alignments;
+    bool            more_alignments,
+		    vcf_uncompressed;
     size_t          previous_vcf_pos = 0,
 		    total_alleles,
 		    depth,
-		    depth_sum = 0;
+		    depth_sum = 0,
+		    header_len = 0,
+		    name_len;
     vcf_stats_t     vcf_stats;
+    mmap_file_t     vcf_map = { NULL, 0, NULL, 0 };
     char            vcf_out_filename[PATH_MAX + 1],
 		    previous_vcf_chromosome[BL_CHROM_MAX_CHARS + 1] = "",
 		    *ext,
@@ -97,6 +105,10 @@ int     ad2vcf(const char *argv[], FILE *sam_stream)
 	exit(EX_NOINPUT);
     }
     
+    name_len = strlen(vcf_filename);
+    vcf_uncompressed = (name_len > 4) &&
+		       (strcmp(vcf_filename + name_len - 4, ".vcf") == 0);
+    
     mapq_min = strtol(argv[2], &end, 10);
     if ( *end != '\0' )
     {
@@ -128,22 +140,46 @@ int     ad2vcf(const char *argv[], FILE *sam_stream)
 
     bl_vcf_init(&vcf_call);
     
-    if ( (vcf_meta_stream = bl_vcf_skip_meta_data(vcf_in_stream)) == NULL )
+    /*
+     *  If the VCF input is an uncompressed regular file, the meta-data
+     *  and header line are a contiguous prefix of it.  Copy them to the
+     *  output in one write from a temporary map and position the stream
+     *  at the first call.  Calls are still read through stdio, which is
+     *  faster for getc()-driven parsers than fmemopen() over the map.
+     */
+    if ( vcf_uncompressed &&
+	 (mmap_file_open(&vcf_map, fileno(vcf_in_stream)) == 0) )
     {
-	fprintf(stderr, "Error reading VCF meta-data.\n");
-	return EX_DATAERR;
+	header_len = vcf_header_len(vcf_map.data, vcf_map.data_len);
+	if ( header_len != 0 )
+	    fwrite(vcf_map.data, header_len, 1, vcf_out_stream);
+	mmap_file_close(&vcf_map);
+	if ( (header_len == 0) ||
+	     (fseeko(vcf_in_stream, header_len, SEEK_CUR) != 0) )
+	{
+	    fprintf(stderr, "Error reading VCF meta-data.\n");
+	    return EX_DATAERR;
+	}
     }
-    
-    // Transfer meta-data to output
-    while ( (ch = getc(vcf_meta_stream)) != EOF )
-	putc(ch, vcf_out_stream);
-    
-    // Transfer header line to output
-    do
+    else
     {
-	ch = getc(vcf_in_stream);
-	putc(ch, vcf_out_stream);
-    }   while ( ch != '\n' );
+	if ( (vcf_meta_stream = bl_vcf_skip_meta_data(vcf_in_stream)) == NULL )
+	{
+	    fprintf(stderr, "Error reading VCF meta-data.\n");
+	    return EX_DATAERR;
+	}
+	
+	// Transfer meta-data to output
+	while ( (ch = getc(vcf_meta_stream)) != EOF )
+	    putc(ch, vcf_out_stream);
+	
+	// Transfer header line to output
+	do
+	{
+	    ch = getc(vcf_in_stream);
+	    putc(ch, vcf_out_stream);
+	}   while ( ch != '\n' );
+    }
 
     while ( bl_vcf_read_ss_call(&vcf_call, vcf_in_stream,
 		BL_VCF_FIELD_ALL) == BL_READ_OK )
@@ -297,6 +333,98 @@ int     ad2vcf(const char *argv[], FILE *sam_stream)
 }
 
 
+/***************************************************************************
+ *  Description:
+ *      Map the remainder of an open file read-only, starting at its
+ *      current offset, and advise the kernel that it will be read
+ *      sequentially.  Only non-empty regular files are mapped, so pipes
+ *      and compressed streams are left to stdio.
+ *
+ *  Returns:
+ *      0 on success, -1 if fd cannot be mapped.  mf->map is NULL on
+ *      failure.
+ ***************************************************************************/
+
+int     mmap_file_open(mmap_file_t *mf, int fd)
+
+{
+    struct stat st;
+    off_t       offset;
+    
+    mf->map = NULL;
+    mf->map_len = mf->data_len = 0;
+    mf->data = NULL;
+    
+    if ( (fstat(fd, &st) != 0) || !S_ISREG(st.st_mode) )
+	return -1;
+    if ( (offset = lseek(fd, 0, SEEK_CUR)) == -1 )
+	return -1;
+    if ( offset >= st.st_size )
+	return -1;
+    
+    mf->map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if ( mf->map == MAP_FAILED )
+    {
+	mf->map = NULL;
+	return -1;
+    }
+    madvise(mf->map, st.st_size, MADV_SEQUENTIAL);
+    
+    mf->map_len = st.st_size;
+    mf->data = (char *)mf->map + offset;
+    mf->data_len = st.st_size - offset;
+    return 0;
+}
+
+
+/***************************************************************************
+ *  Description:
+ *      Unmap a file mapped by mmap_file_open()
+ ***************************************************************************/
+
+void    mmap_file_close(mmap_file_t *mf)
+
+{
+    if ( mf->map != NULL )
+	munmap(mf->map, mf->map_len);
+    mf->map = NULL;
+    mf->map_len = mf->data_len = 0;
+    mf->data = NULL;
+}
+
+
+/***************************************************************************
+ *  Description:
+ *      Find the end of the VCF meta-data and header in a mapped VCF file.
+ *      Meta-data lines begin with "##" and the header line with a single
+ *      '#', so the first line not beginning with "##" must be the header.
+ *
+ *  Returns:
+ *      Length of meta-data plus header line, including its newline,
+ *      or 0 if no header line is found.
+ ***************************************************************************/
+
+size_t  vcf_header_len(const char *data, size_t data_len)
+
+{
+    const char  *line = data,
+		*end = data + data_len,
+		*nl;
+    
+    while ( line < end )
+    {
+	if ( (nl = memchr(line, '\n', end - line)) == NULL )
+	    return 0;
+	if ( *line != '#' )
+	    return 0;
+	if ( (nl - line < 2) || (line[1] != '#') )
+	    return nl + 1 - data;
+	line = nl + 1;
+    }
+    return 0;
+}
+
+
 /***************************************************************************
  *  Description:
  *      Skip alignments upstream of the given VCF call chromosome and pos
@@ -51,6 +51,20 @@ typedef struct
     unsigned    mask;
 }   vcf_stats_t;
 
+/*
+ *  Read-only mapping of an uncompressed regular input file.  data and
+ *  data_len describe the unread portion, starting at the file offset
+ *  at the time of mapping.
+ */
+
+typedef struct
+{
+    void        *map;
+    size_t      map_len;
+    char        *data;
+    size_t      data_len;
+}   mmap_file_t;
+
 #define VCF_STATS_MASK_ALLELE       0x01
 #define VCF_STATS_MASK_CHECK_PHREDS 0X02
 